@@ -191,6 +191,70 @@ void Foam::PstreamDetail::allReduce
     }
     else
 #endif
+    if (UPstream::useHostReduce(comm))
+    {
+        // Reduce within host, between host leaders, broadcast within host
+        const label intraComm = UPstream::commIntraHost();
+        const label interComm = UPstream::commInterHost();
+
+        profilingPstream::beginTiming();
+
+        bool failed =
+        (
+            MPI_Reduce
+            (
+                (UPstream::master(intraComm) ? MPI_IN_PLACE : values),
+                values,
+                count,
+                datatype,
+                optype,
+                0,  // root: host leader
+                PstreamGlobals::MPICommunicators_[intraComm]
+            )
+        );
+
+        if (!failed && UPstream::is_rank(interComm))
+        {
+            failed =
+            (
+                MPI_Allreduce
+                (
+                    MPI_IN_PLACE,  // recv is also send
+                    values,
+                    count,
+                    datatype,
+                    optype,
+                    PstreamGlobals::MPICommunicators_[interComm]
+                )
+            );
+        }
+
+        if (!failed)
+        {
+            failed =
+            (
+                MPI_Bcast
+                (
+                    values,
+                    count,
+                    datatype,
+                    0,  // root: host leader
+                    PstreamGlobals::MPICommunicators_[intraComm]
+                )
+            );
+        }
+
+        if (failed)
+        {
+            FatalErrorInFunction
+                << "Host-based reduction failed for "
+                << UList<Type>(values, count)
+                << Foam::abort(FatalError);
+        }
+
+        profilingPstream::addReduceTime();
+    }
+    else
     {
         profilingPstream::beginTiming();
 